@@ -2,7 +2,9 @@
 
 #include <bolt/constraints.hpp>
 #include <bolt/export.hpp>
+#include <bolt/objectives.hpp>
 #include <bolt/types.hpp>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -30,6 +32,9 @@ public:
     // Add variable with discrete domain
     void addVariable(const VariableId& id, const DomainValues& domain);
 
+    // Add integer variable with domain [min, max] (values are not materialized)
+    void addVariable(const VariableId& id, int min, int max);
+
     // Add constraint to problem
     void addConstraint(std::shared_ptr<Constraint> constraint);
 
@@ -49,6 +54,39 @@ public:
     // Validate partial assignment
     ValidationResult validate(const Assignment& assignment) const;
 
+    // Repair an invalid proposal with local search, keeping as many of its
+    // values as possible. Variables missing from the proposal are filled in
+    RepairResult repair(const Assignment& proposal);
+
+    // Explain why the problem has no solution: a minimal subset of
+    // constraints that is unsatisfiable on its own, reported as violations.
+    // is_valid is true only if the problem was proven satisfiable; if the
+    // time limit cuts the check off, is_conclusive is false instead
+    ValidationResult explainInfeasibility();
+
+    // ========================================================================
+    // Optimization
+    // ========================================================================
+
+    // Set cost to minimize (nullptr = satisfaction only). The objective is
+    // not modified by solving and may be shared between solvers
+    void setObjective(std::shared_ptr<Objective> objective);
+
+    // Invoked for every improving solution; return false to stop early
+    using SolutionCallback = std::function<bool(const Solution&)>;
+
+    // Minimize the objective until proven optimal, timeout, or the callback
+    // stops the search. Returns the best solution found (anytime). Throws
+    // std::invalid_argument if the objective refers to an unknown variable
+    Solution optimize(const SolutionCallback& on_improvement = {});
+
+    enum class OptimizationMode {
+        BranchAndBound,          // Complete search, prunes on objective bound
+        LargeNeighborhoodSearch  // Relax and re-solve neighborhoods of the incumbent
+    };
+    void setOptimizationMode(OptimizationMode mode);
+    void setLargeNeighborhoodOptions(const LargeNeighborhoodOptions& options);
+
     // ========================================================================
     // Configuration
     // ========================================================================
@@ -76,6 +114,23 @@ public:
     };
     void setValueOrdering(ValueOrdering ordering);
 
+    // Let a learned model pick orderings, propagation and presolve per
+    // problem class at solve time (overrides the setters above)
+    void setAutoTuningEnabled(bool enabled);
+
+    // Load a model file trained by bolt_tune (JSON). Only this solver's
+    // model is replaced; the global utils::Config is not modified
+    bool loadTuningModel(const std::string& path);
+
+    // Configure root-level presolve (runs once, reused until problem changes)
+    void setPresolveOptions(const PresolveOptions& options);
+
+    // Configure local search used by repair()
+    void setLocalSearchOptions(const LocalSearchOptions& options);
+
+    // Configure conflict extraction used by explainInfeasibility()
+    void setExplanationOptions(const ExplanationOptions& options);
+
     // ========================================================================
     // Statistics
     // ========================================================================
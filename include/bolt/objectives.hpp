@@ -0,0 +1,41 @@
+#pragma once
+
+#include <bolt/export.hpp>
+#include <bolt/types.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace bolt {
+
+// Forward declaration
+class Objective;
+
+// ============================================================================
+// Objective Factory Functions (Public API)
+// ============================================================================
+// All objectives are minimized; numeric values (int, double, bool) are
+// converted to double.
+
+// Minimize sum(variables), e.g. total resource usage
+BOLT_API std::shared_ptr<Objective> MinimizeSum(const std::vector<VariableId>& variables);
+
+// Minimize sum(weight * variable)
+BOLT_API std::shared_ptr<Objective> MinimizeWeightedSum(
+    const std::vector<std::pair<VariableId, double>>& terms);
+
+// Minimize max(variables), e.g. makespan over end times
+BOLT_API std::shared_ptr<Objective> MinimizeMax(const std::vector<VariableId>& variables);
+
+// Minimize the number of variables that differ from a reference assignment,
+// e.g. distance from the proposed plan. Every key of reference must be a
+// solver variable (optimize() throws std::invalid_argument otherwise)
+BOLT_API std::shared_ptr<Objective> MinimizeChanges(const Assignment& reference);
+
+// Custom cost over a complete assignment (no bound on partial assignments,
+// so branch-and-bound can only prune at the leaves)
+BOLT_API std::shared_ptr<Objective> CustomObjective(
+    const std::vector<VariableId>& scope, std::function<double(const Assignment&)> cost);
+
+}  // namespace bolt
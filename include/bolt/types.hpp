@@ -42,6 +42,10 @@ struct BOLT_API Solution {
     bool is_satisfied;
     double solve_time_ms;
     size_t backtracks;
+
+    // Optimization (set when an objective is configured)
+    std::optional<double> objective_value;
+    bool is_optimal;  // Search space exhausted, no better solution exists
 };
 
 // Problem definition
@@ -57,6 +61,16 @@ struct BOLT_API SolverStats {
     size_t constraint_checks;
     size_t domain_reductions;
     double total_time_ms;
+
+    // Presolve reductions (see PresolveOptions)
+    size_t presolve_values_removed;
+    size_t presolve_constraints_removed;
+    size_t presolve_variables_fixed;
+    double presolve_time_ms;
+
+    // Optimization
+    size_t improving_solutions;
+    size_t lns_iterations;
 };
 
 // Constraint violation information
@@ -70,6 +84,64 @@ struct BOLT_API Violation {
 struct BOLT_API ValidationResult {
     bool is_valid;
     std::vector<Violation> violations;
+    bool is_conclusive = true;  // False if a check was cut off before deciding
+};
+
+// Result of repairing a proposed assignment (local search)
+struct BOLT_API RepairResult {
+    Assignment assignment;                      // Best assignment found
+    bool is_satisfied;                          // All constraints hold
+    std::vector<VariableId> changed_variables;  // Variables differing from the proposal
+    size_t remaining_violations;                // Violated constraints (0 if satisfied)
+    size_t moves;
+    double solve_time_ms;
+};
+
+// ============================================================================
+// Configuration Types
+// ============================================================================
+
+// Root-level problem reductions applied once before search
+struct BOLT_API PresolveOptions {
+    bool enabled = true;
+    bool fold_unary_constraints = true;       // Apply unary constraints to domains
+    bool merge_redundant_constraints = true;  // Drop duplicate/subsumed constraints
+    bool eliminate_fixed_variables = true;    // Remove singleton-domain variables
+    bool singleton_arc_consistency = false;   // SAC pass (can be expensive)
+    double sac_time_limit_ms = 10.0;          // Budget for the SAC pass (0 = unbounded)
+
+    bool operator==(const PresolveOptions&) const = default;
+};
+
+// Min-conflicts / tabu local search used to repair proposed assignments.
+// repair() stops at whichever of time_limit_ms / max_moves comes first
+// (0 disables that limit). If both are 0, the solver timeout is used as the
+// time limit, and if that is 0 as well, the default 5 ms, so repair() always
+// terminates on infeasible problems
+struct BOLT_API LocalSearchOptions {
+    double time_limit_ms = 5.0;            // Deadline for the repair (0 = no deadline)
+    size_t max_moves = 0;                  // Move budget (0 = no move limit)
+    size_t tabu_tenure = 10;               // Moves a changed variable stays tabu
+    double random_walk_probability = 0.1;  // Chance of a random move instead of min-conflicts
+    bool stop_at_first_solution = false;   // Otherwise keep looking for a closer solution
+    uint64_t seed = 0;
+};
+
+// Large neighborhood search: relax part of the incumbent and re-solve
+struct BOLT_API LargeNeighborhoodOptions {
+    double relax_fraction = 0.3;  // Fraction of variables freed per iteration
+    size_t node_limit = 1000;     // Search nodes per neighborhood re-solve
+    size_t max_iterations = 0;    // 0 = until timeout or callback stops
+    uint64_t seed = 0;
+};
+
+// Minimal conflict extraction (QuickXplain) for infeasible problems
+struct BOLT_API ExplanationOptions {
+    size_t num_threads = 0;           // 0 = hardware concurrency
+    size_t parallel_depth = 4;        // Recursion depth below which halves run concurrently
+    size_t check_node_limit = 10000;  // Nodes per sub-check (whole problem: unlimited)
+    size_t snapshot_cache_size = 64;  // Propagated domain snapshots kept for reuse
+    double time_limit_ms = 0.0;       // 0 = solver timeout (may be non-minimal on timeout)
 };
 
 }  // namespace bolt
@@ -36,6 +36,11 @@ public:
     // Constraint name/type
     virtual std::string name() const = 0;
 
+    // Redundancy detection (presolve)
+    // Default: a constraint is only equivalent to itself and subsumes nothing
+    virtual bool isEquivalentTo(const Constraint& other) const;
+    virtual bool subsumes(const Constraint& other) const;
+
 protected:
     // Helper: Check if all variables in scope are assigned
     bool allAssigned(const std::vector<VariableId>& scope,
@@ -57,6 +62,7 @@ public:
     size_t arity() const override { return 2; }
     std::string toString() const override;
     std::string name() const override { return "NotEqual"; }
+    bool isEquivalentTo(const Constraint& other) const override;
 
 private:
     VariableId x_;
@@ -74,6 +80,8 @@ public:
     size_t arity() const override { return variables_.size(); }
     std::string toString() const override;
     std::string name() const override { return "AllDifferent"; }
+    bool isEquivalentTo(const Constraint& other) const override;
+    bool subsumes(const Constraint& other) const override;  // NotEqual / smaller AllDifferent
 
 private:
     std::vector<VariableId> variables_;
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "int_domain.hpp"
 #include <bolt/types.hpp>
 #include <algorithm>
 #include <optional>
+#include <variant>
 #include <vector>
 
 namespace bolt {
@@ -12,33 +14,105 @@ namespace internal {
 // Domain: Represents valid values for a variable
 // ============================================================================
 
+// Storage used by a domain (chosen by Variable from the domain's shape)
+enum class DomainKind {
+    Explicit,  // Any value types, stored as a value list
+    Interval,  // Large integer ranges: bounds + holes/bitmap
+    SparseSet  // Moderate integer ranges: O(1) removal, reversible
+};
+
 class Domain {
 public:
     // Constructors
     explicit Domain(const DomainValues& values);
+    Domain(int min, int max, DomainKind kind);                // Integer range
+    Domain(const std::vector<int>& values, DomainKind kind);  // Integer set
     Domain(const Domain&) = default;
     Domain& operator=(const Domain&) = default;
 
+    DomainKind kind() const;
+
     // Domain queries
     size_t size() const;
     bool isEmpty() const;
     bool contains(const ValueType& value) const;
-    const DomainValues& values() const;
+
+    // Builds the full value list on every call (nothing is cached, so const
+    // access is safe from several threads); prefer forEachValue on hot paths
+    DomainValues values() const;
+
+    // Iteration without materializing: visit(const ValueType&) -> bool,
+    // stops when the visitor returns false. Explicit domains are visited in
+    // list order, integer kinds in increasing order (Natural value ordering
+    // relies on this)
+    template <typename Visitor>
+    void forEachValue(Visitor&& visit) const;
+
+    // Value at position index < size() of an Explicit domain's list (O(1),
+    // for random sampling); nullopt for integer kinds, sample those with nextInt
+    std::optional<ValueType> explicitValueAt(size_t index) const;
+
+    // Smallest value >= from (integer kinds; Explicit: smallest int >= from)
+    std::optional<int> nextInt(int from) const;
+
+    // Integer bounds (nullopt for Explicit domains with non-int values)
+    std::optional<int> minInt() const;
+    std::optional<int> maxInt() const;
 
     // Domain modification
     bool removeValue(const ValueType& value);
     void removeValues(const std::vector<ValueType>& values);
     void intersect(const Domain& other);
 
-    // Get arbitrary value (for backtracking)
+    // Bound tightening for integer kinds (Explicit: filters the value list)
+    bool removeBelow(int value);
+    bool removeAbove(int value);
+
+    // First value in forEachValue order (for backtracking)
     std::optional<ValueType> getFirstValue() const;
 
     // Domain restoration (for backtracking)
     Domain copy() const;
 
+    // Cheap restoration for SparseSet domains (size checkpoint, no copy);
+    // other kinds return nullopt and must be restored with copy()
+    std::optional<size_t> checkpoint() const;
+    void restore(size_t checkpoint);
+
 private:
-    DomainValues values_;
+    using Representation = std::variant<DomainValues, IntervalDomain, SparseSetDomain>;
+
+    Representation values_;
 };
 
+template <typename Visitor>
+void Domain::forEachValue(Visitor&& visit) const {
+    if (const auto* values = std::get_if<DomainValues>(&values_)) {
+        for (const auto& value : *values) {
+            if (!visit(value)) {
+                return;
+            }
+        }
+    } else if (const auto* interval = std::get_if<IntervalDomain>(&values_)) {
+        for (auto value = interval->next(interval->min()); value;
+             value = *value < interval->max() ? interval->next(*value + 1) : std::nullopt) {
+            if (!visit(ValueType{*value})) {
+                return;
+            }
+        }
+    } else {
+        const auto& set = std::get<SparseSetDomain>(values_);
+        if (set.isEmpty()) {
+            return;
+        }
+        for (auto value = set.next(set.min()); value;
+             value = *value < set.max() ? set.next(*value + 1) : std::nullopt) {
+            if (!visit(ValueType{*value})) {
+                return;
+            }
+        }
+    }
+}
+
 }  // namespace internal
 }  // namespace bolt
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "constraint.hpp"
+#include "domain.hpp"
+#include "variable.hpp"
+#include <bolt/types.hpp>
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// Constraint subsets are passed around as sorted indices into the problem's
+// constraint list
+using ConstraintSet = std::vector<size_t>;
+
+// Outcome of a consistency check; Unknown means the node limit or deadline
+// cut the search off before it could decide
+enum class CheckResult { Consistent, Inconsistent, Unknown };
+
+// ============================================================================
+// Consistency Oracle: Satisfiability of constraint subsets
+// ============================================================================
+
+// Answers "is this subset of constraints satisfiable?" for QuickXplain.
+// Checks are AC-3 followed by a node-limited search. Domains obtained after
+// propagating a background set are cached, so checks that extend a recently
+// seen background only propagate the additional constraints.
+// Thread-safety: the constructor copies the root domains, and checks never
+// touch the solver's variables afterwards. Each check builds private
+// Variables from a snapshot, so concurrent checks share only the immutable
+// snapshots and the mutex-guarded cache.
+class ConsistencyOracle {
+public:
+    using Clock = std::chrono::high_resolution_clock;
+
+    // variables must hold the original, pre-presolve domains: presolve
+    // reductions (folded unary constraints, SAC) follow from the whole
+    // constraint set, so starting from them would make every subset look
+    // inconsistent. SolverImpl passes variables_, never search_variables_.
+    // Must not run concurrently with anything that modifies variables
+    ConsistencyOracle(const std::vector<std::unique_ptr<Variable>>& variables,
+                      const std::vector<std::shared_ptr<Constraint>>& constraints,
+                      size_t node_limit, size_t cache_capacity);
+
+    // Is background ∪ extra satisfiable? Search is cut off after node_limit
+    // nodes (0 = unlimited) or at deadline, yielding Unknown
+    CheckResult isConsistent(const ConstraintSet& background, const ConstraintSet& extra,
+                             size_t node_limit,
+                             std::optional<Clock::time_point> deadline);
+
+    // Convenience overload using the oracle's node limit and no deadline
+    CheckResult isConsistent(const ConstraintSet& background, const ConstraintSet& extra);
+
+    size_t checks() const { return checks_.load(std::memory_order_relaxed); }
+    size_t cacheHits() const { return cache_hits_.load(std::memory_order_relaxed); }
+
+private:
+    // Domains (by variable position) after propagating a constraint set
+    struct Snapshot {
+        ConstraintSet constraints;
+        std::vector<Domain> domains;
+        bool consistent;
+    };
+
+    // Most specific cached snapshot whose set is a subset of background
+    std::shared_ptr<const Snapshot> findSnapshot(const ConstraintSet& background);
+    void storeSnapshot(std::shared_ptr<const Snapshot> snapshot);
+
+    // Propagate (and search) from a snapshot with the given additional constraints
+    CheckResult check(const Snapshot& start, const ConstraintSet& added, size_t node_limit,
+                      std::optional<Clock::time_point> deadline,
+                      std::vector<Domain>* propagated_domains);
+
+    std::vector<VariableId> variable_ids_;  // By variable position
+    std::shared_ptr<const Snapshot> root_;  // Copied root domains, no constraints
+
+    // Shared by concurrent checks: propagate() must not keep per-call state
+    const std::vector<std::shared_ptr<Constraint>>& constraints_;
+    size_t node_limit_;
+    size_t cache_capacity_;
+
+    std::mutex cache_mutex_;
+    std::list<std::shared_ptr<const Snapshot>> cache_;  // Most recently used first
+
+    std::atomic<size_t> checks_{0};
+    std::atomic<size_t> cache_hits_{0};
+};
+
+// ============================================================================
+// Conflict Explainer: Minimal unsatisfiable core (QuickXplain)
+// ============================================================================
+
+class ConflictExplainer {
+public:
+    // variables: original domains (see ConsistencyOracle)
+    ConflictExplainer(const std::vector<std::unique_ptr<Variable>>& variables,
+                      const std::vector<std::shared_ptr<Constraint>>& constraints,
+                      const ExplanationOptions& options);
+
+    // Requires every original domain to be non-empty (QuickXplain needs the
+    // empty constraint set to be satisfiable; explain() checks this first).
+    // Decides the whole problem with no node limit, bounded only by
+    // options.time_limit_ms (SolverImpl substitutes its timeout for 0; if
+    // that is 0 too, the check is unbounded). Then:
+    // - Consistent: empty set
+    // - Inconsistent: minimal subset of constraints unsatisfiable on its own
+    // - Unknown (deadline hit): nullopt; never reported as satisfiable
+    // Inside QuickXplain an Unknown sub-check is treated as satisfiable, which
+    // keeps the returned set conflicting but may leave it non-minimal
+    std::optional<ConstraintSet> findMinimalConflict();
+
+    // Minimal conflict reported as violations:
+    // - satisfiable: is_valid = true, is_conclusive = true
+    // - empty original domain: is_valid = false, one "EmptyDomain" violation
+    //   per such variable (no constraints involved)
+    // - infeasible: is_valid = false, violations = the conflict
+    // - undetermined: is_valid = false, is_conclusive = false, no violations
+    ValidationResult explain();
+
+private:
+    using Clock = ConsistencyOracle::Clock;
+
+    // QuickXplain (Junker 2004): minimal C' ⊆ constraints such that
+    // background ∪ C' is unsatisfiable. has_delta is false on the first call,
+    // letting the consistency check of background be skipped.
+    // Below options.parallel_depth, the two halves are explored concurrently:
+    // the consistency check that decides whether the first half is needed runs
+    // alongside a speculative explanation of the second half
+    ConstraintSet quickXplain(const ConstraintSet& background, bool has_delta,
+                              const ConstraintSet& constraints, size_t depth);
+
+    // Spawn a worker if the thread budget allows, otherwise run inline
+    bool tryAcquireThread();
+    void releaseThread();
+
+    bool isTimedOut() const;
+
+    const std::vector<std::shared_ptr<Constraint>>& constraints_;
+    ExplanationOptions options_;
+    ConsistencyOracle oracle_;
+
+    std::atomic<size_t> active_threads_{0};
+    size_t max_threads_;
+    Clock::time_point start_time_;
+};
+
+}  // namespace internal
+}  // namespace bolt
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <bolt/types.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// ============================================================================
+// IntervalDomain: [min, max] with removed values
+// ============================================================================
+
+// Stores bounds plus a sorted list of interior holes. Once holes would take
+// more memory than a bitmap over [min, max], switches to the bitmap.
+// Values are never materialized unless requested.
+class IntervalDomain {
+public:
+    IntervalDomain(int min, int max);
+
+    int min() const { return min_; }
+    int max() const { return max_; }
+    size_t size() const { return size_; }
+    bool isEmpty() const { return size_ == 0; }
+    bool contains(int value) const;
+
+    // Removing a bound tightens it (skipping holes); otherwise adds a hole
+    bool remove(int value);
+
+    // Bound tightening, O(removed holes)
+    bool removeBelow(int value);
+    bool removeAbove(int value);
+
+    // Smallest value >= from, if any (iteration without materializing)
+    std::optional<int> next(int from) const;
+
+    // Append all values in increasing order
+    void appendValues(DomainValues& out) const;
+
+    bool usesBitmap() const { return !bitmap_.empty(); }
+
+private:
+    // Move holes into a bitmap based at min_
+    void switchToBitmap();
+    bool shouldSwitchToBitmap() const;
+
+    // Advance min_/max_ past removed values after a bound removal
+    void normalizeBounds();
+
+    bool bitmapTest(int value) const;
+    void bitmapClear(int value);
+
+    int min_;
+    int max_;
+    size_t size_;
+    std::vector<int> holes_;        // Sorted, strictly inside (min_, max_)
+    std::vector<uint64_t> bitmap_;  // Bit i set = bitmap_base_ + i present
+    int bitmap_base_ = 0;
+};
+
+// ============================================================================
+// SparseSetDomain: Reversible integer set with O(1) removal
+// ============================================================================
+
+// Classic sparse set: dense_[0, size_) holds the live values, sparse_ maps
+// value - offset_ to its position in dense_. Removal swaps the value behind
+// the live prefix, so restoring a checkpoint is just resetting size_ (no
+// copying on backtrack). Memory is O(max - min). dense_ order depends on
+// removal history, so ordered iteration (next) scans sparse_ instead.
+class SparseSetDomain {
+public:
+    SparseSetDomain(int min, int max);
+    explicit SparseSetDomain(const std::vector<int>& values);
+
+    size_t size() const { return size_; }
+    bool isEmpty() const { return size_ == 0; }
+
+    bool contains(int value) const {
+        if (value < offset_ || static_cast<size_t>(value - offset_) >= sparse_.size()) {
+            return false;
+        }
+        return sparse_[value - offset_] < size_;
+    }
+
+    bool remove(int value) {
+        if (!contains(value)) {
+            return false;
+        }
+        const uint32_t pos = sparse_[value - offset_];
+        const int last = dense_[size_ - 1];
+        dense_[pos] = last;
+        sparse_[last - offset_] = pos;
+        dense_[size_ - 1] = value;
+        sparse_[value - offset_] = static_cast<uint32_t>(size_ - 1);
+        --size_;
+        if (size_ > 0) {
+            // Tighten the cached bounds past removed values (amortized by removals)
+            if (value == min_) {
+                while (!contains(min_)) {
+                    ++min_;
+                }
+            } else if (value == max_) {
+                while (!contains(max_)) {
+                    --max_;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Reversibility: values removed after checkpoint() come back on restore().
+    // The restored values sit at dense_[size_, checkpoint), so widening the
+    // cached bounds costs O(restored values)
+    size_t checkpoint() const { return size_; }
+    void restore(size_t checkpoint) {
+        if (size_ == 0 && checkpoint > 0) {
+            min_ = max_ = dense_[0];
+        }
+        for (size_t i = size_; i < checkpoint; ++i) {
+            min_ = std::min(min_, dense_[i]);
+            max_ = std::max(max_, dense_[i]);
+        }
+        size_ = checkpoint;
+    }
+
+    // Live values in dense order, which depends on removal history; use
+    // next() where values must come out in increasing order
+    const int* begin() const { return dense_.data(); }
+    const int* end() const { return dense_.data() + size_; }
+
+    // Smallest value >= from, if any: scans sparse_ over the span, O(max - from)
+    std::optional<int> next(int from) const;
+
+    // Cached bounds, maintained by remove() and restore(); unspecified if empty
+    int min() const { return min_; }
+    int max() const { return max_; }
+
+    // Append all values in increasing order
+    void appendValues(DomainValues& out) const;
+
+private:
+    int offset_;
+    std::vector<int> dense_;
+    std::vector<uint32_t> sparse_;  // Values never in the set map past dense_.size()
+    size_t size_;
+    int min_;
+    int max_;
+};
+
+}  // namespace internal
+}  // namespace bolt
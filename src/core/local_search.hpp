@@ -0,0 +1,116 @@
+#pragma once
+
+#include "constraint.hpp"
+#include "domain.hpp"
+#include "variable.hpp"
+#include <bolt/types.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// ============================================================================
+// Local Search: Min-conflicts with tabu and random walk
+// ============================================================================
+
+// Repairs a complete (possibly invalid) assignment by moving one variable at
+// a time. Variables and constraints are indexed densely so that a move only
+// re-evaluates the constraints adjacent to the moved variable (O(degree)).
+class LocalSearchSolver {
+public:
+    // options must bound the search (time_limit_ms or max_moves non-zero);
+    // SolverImpl::effectiveLocalSearchOptions() guarantees this
+    LocalSearchSolver(const std::vector<std::unique_ptr<Variable>>& variables,
+                      const std::vector<std::shared_ptr<Constraint>>& constraints,
+                      const LocalSearchOptions& options);
+
+    // Search for a consistent assignment close to the proposal
+    // Ties between equally good moves are broken towards proposal values.
+    // Proposal values outside a variable's domain are never kept: they count
+    // as changed and are replaced in initialize(), so is_satisfied implies
+    // every returned value is in its domain
+    RepairResult repair(const Assignment& proposal);
+
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Candidate values evaluated per min-conflicts move. Larger domains are
+    // sampled (plus the proposal's value) instead of scanned
+    static constexpr size_t MAX_MOVE_CANDIDATES = 64;
+
+    struct VarState {
+        const Variable* var;
+        Domain domain;                      // Copy of the current domain (not materialized)
+        std::vector<size_t> constraints;    // Indices into constraints_
+        ValueType current;
+        std::optional<ValueType> proposed;  // The proposal's value, if any (may be out of domain)
+        size_t conflicts = 0;               // Violated constraints involving the variable
+        size_t tabu_until = 0;              // Move number until which it is tabu
+    };
+
+    struct Move {
+        size_t var;
+        ValueType value;
+        long delta;  // Change in number of violated constraints
+    };
+
+    // Values to evaluate for var: the whole domain if it has at most
+    // MAX_MOVE_CANDIDATES values, otherwise a random sample plus the
+    // proposal's value if domain.contains() it. Explicit domains are sampled
+    // by random index (Domain::explicitValueAt), since nextInt only sees their
+    // int values; integer kinds by Domain::nextInt from random points
+    void collectCandidates(size_t var, std::vector<ValueType>& out);
+
+    // Build initial state from proposal. Missing and out-of-domain values
+    // are replaced by the in-domain candidate with fewest conflicts
+    void initialize(const Assignment& proposal);
+
+    // Violations introduced (+) or removed (-) by setting var to value
+    long evaluateMove(size_t var, const ValueType& value);
+
+    // Apply move and update violation counts of adjacent constraints
+    void applyMove(const Move& move);
+
+    // Best non-tabu move for a conflicted variable (aspiration: a tabu move
+    // is allowed if it improves on the best assignment seen so far)
+    Move selectMinConflictsMove();
+    Move selectRandomWalkMove();
+
+    // Number of variables whose value differs from the proposal
+    size_t distanceFromProposal() const;
+
+    // Record current assignment if it beats the best one so far
+    // (fewer violations first, then smaller distance from the proposal)
+    void updateBest();
+
+    bool isTimedOut() const;
+
+    const std::vector<std::shared_ptr<Constraint>>& constraints_;
+    LocalSearchOptions options_;
+    std::mt19937_64 rng_;
+
+    std::vector<VarState> vars_;
+    Assignment current_;
+    std::vector<bool> violated_;  // Per-constraint violation flag
+
+    // Variables with conflicts > 0, as a sparse set for O(1) update/sampling
+    std::vector<size_t> conflicted_;
+    std::vector<size_t> conflicted_pos_;
+
+    size_t violation_count_ = 0;
+    size_t moves_ = 0;
+
+    Assignment best_;
+    size_t best_violations_ = 0;
+    size_t best_distance_ = 0;
+
+    Clock::time_point start_time_;
+};
+
+}  // namespace internal
+}  // namespace bolt
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "variable.hpp"
+#include <bolt/types.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// ============================================================================
+// Bound Objective: Per-solve lower-bound evaluator
+// ============================================================================
+
+// An objective resolved against one solver's variables. Created by
+// Objective::bind() at the start of optimize() and owned by SolverImpl for
+// that solve, so the shared Objective itself is never modified
+class BoundObjective {
+public:
+    virtual ~BoundObjective() = default;
+
+    // Lower bound on the cost of any completion of the current partial
+    // assignment (branch-and-bound hot path). Reads assigned values and
+    // domains through the bound variables, with no id lookups
+    virtual double lowerBound() const = 0;
+};
+
+// ============================================================================
+// Abstract Objective Base Class (minimization)
+// ============================================================================
+
+// Immutable once constructed: one objective may be shared by several solvers
+class Objective {
+public:
+    virtual ~Objective() = default;
+
+    // Cost of a complete assignment
+    virtual double evaluate(const Assignment& assignment) const = 0;
+
+    // Resolve the scope to the given variables. Throws std::invalid_argument
+    // if a scope variable does not exist (a modelling error, not infeasibility)
+    virtual std::unique_ptr<BoundObjective> bind(
+        const std::vector<std::unique_ptr<Variable>>& variables) const = 0;
+
+    // Variables the cost depends on
+    virtual std::vector<VariableId> getScope() const = 0;
+
+    // Human-readable description
+    virtual std::string toString() const = 0;
+
+    // Objective name/type
+    virtual std::string name() const = 0;
+
+protected:
+    // Helper: Numeric view of a value (int, double, bool); throws otherwise
+    static double toNumber(const ValueType& value);
+
+    // Helper: Variables for ids, in order; throws std::invalid_argument
+    // naming the first missing id
+    static std::vector<const Variable*> resolve(
+        const std::vector<VariableId>& ids,
+        const std::vector<std::unique_ptr<Variable>>& variables);
+};
+
+// ============================================================================
+// Concrete Objective Implementations
+// ============================================================================
+
+// sum(weight * variable); bound uses the best domain value of each term
+class WeightedSumObjective : public Objective {
+public:
+    explicit WeightedSumObjective(std::vector<std::pair<VariableId, double>> terms);
+
+    double evaluate(const Assignment& assignment) const override;
+    std::unique_ptr<BoundObjective> bind(
+        const std::vector<std::unique_ptr<Variable>>& variables) const override;
+    std::vector<VariableId> getScope() const override;
+    std::string toString() const override;
+    std::string name() const override { return "WeightedSum"; }
+
+private:
+    std::vector<std::pair<VariableId, double>> terms_;
+};
+
+// max(variables); bound is the max over assigned values and domain minima
+class MaxObjective : public Objective {
+public:
+    explicit MaxObjective(std::vector<VariableId> variables);
+
+    double evaluate(const Assignment& assignment) const override;
+    std::unique_ptr<BoundObjective> bind(
+        const std::vector<std::unique_ptr<Variable>>& variables) const override;
+    std::vector<VariableId> getScope() const override;
+    std::string toString() const override;
+    std::string name() const override { return "Max"; }
+
+private:
+    std::vector<VariableId> variables_;
+};
+
+// Number of variables differing from a reference assignment; an unassigned
+// variable adds to the bound only if its domain no longer has the reference value
+class HammingDistanceObjective : public Objective {
+public:
+    explicit HammingDistanceObjective(Assignment reference);
+
+    double evaluate(const Assignment& assignment) const override;
+    std::unique_ptr<BoundObjective> bind(
+        const std::vector<std::unique_ptr<Variable>>& variables) const override;
+    std::vector<VariableId> getScope() const override;
+    std::string toString() const override;
+    std::string name() const override { return "HammingDistance"; }
+
+private:
+    Assignment reference_;
+};
+
+// User-provided cost; bound is -infinity until all scope variables are
+// assigned (the assignment passed to cost is built only at that point)
+class FunctionObjective : public Objective {
+public:
+    FunctionObjective(std::vector<VariableId> scope,
+                      std::function<double(const Assignment&)> cost);
+
+    double evaluate(const Assignment& assignment) const override;
+    std::unique_ptr<BoundObjective> bind(
+        const std::vector<std::unique_ptr<Variable>>& variables) const override;
+    std::vector<VariableId> getScope() const override;
+    std::string toString() const override;
+    std::string name() const override { return "Function"; }
+
+private:
+    std::vector<VariableId> scope_;
+    std::function<double(const Assignment&)> cost_;
+};
+
+// ============================================================================
+// Concrete Bound Objectives (returned by the bind() overrides above)
+// ============================================================================
+
+class WeightedSumBound : public BoundObjective {
+public:
+    explicit WeightedSumBound(std::vector<std::pair<const Variable*, double>> terms);
+    double lowerBound() const override;
+
+private:
+    std::vector<std::pair<const Variable*, double>> terms_;
+};
+
+class MaxBound : public BoundObjective {
+public:
+    explicit MaxBound(std::vector<const Variable*> variables);
+    double lowerBound() const override;
+
+private:
+    std::vector<const Variable*> variables_;
+};
+
+class HammingDistanceBound : public BoundObjective {
+public:
+    explicit HammingDistanceBound(std::vector<std::pair<const Variable*, ValueType>> reference);
+    double lowerBound() const override;
+
+private:
+    std::vector<std::pair<const Variable*, ValueType>> reference_;  // Variable, reference value
+};
+
+// Copies the cost function, so it does not depend on the FunctionObjective
+// that created it
+class FunctionBound : public BoundObjective {
+public:
+    FunctionBound(std::vector<const Variable*> scope,
+                  std::function<double(const Assignment&)> cost);
+    double lowerBound() const override;
+
+private:
+    std::vector<const Variable*> scope_;
+    std::function<double(const Assignment&)> cost_;
+};
+
+}  // namespace internal
+}  // namespace bolt
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "constraint.hpp"
+#include "variable.hpp"
+#include <bolt/types.hpp>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// ============================================================================
+// Presolve Result
+// ============================================================================
+
+// Reduced problem produced by Presolver::run. SolverImpl keeps it and
+// replays it on later solves until the problem or the effective
+// PresolveOptions change.
+struct PresolveResult {
+    // False if a pass proved the problem infeasible (empty domain)
+    bool feasible = true;
+
+    // Variables removed from search and their forced values
+    Assignment fixed_assignment;
+
+    // Domains of the remaining variables after all passes (copies keep the
+    // variable's representation, so integer ranges stay unmaterialized)
+    std::unordered_map<VariableId, Domain> reduced_domains;
+
+    // Constraints that still have to be enforced during search
+    std::vector<std::shared_ptr<Constraint>> active_constraints;
+
+    // Reduction counters (reported through SolverStats)
+    size_t values_removed = 0;
+    size_t constraints_removed = 0;
+    size_t variables_fixed = 0;
+    double time_ms = 0.0;
+};
+
+// ============================================================================
+// Presolver: Root-level problem simplification
+// ============================================================================
+
+class Presolver {
+public:
+    // Run all enabled passes until no pass reduces the problem further.
+    // The passes work on a private copy; variables are never modified
+    static PresolveResult run(const std::vector<std::unique_ptr<Variable>>& variables,
+                              const std::vector<std::shared_ptr<Constraint>>& constraints,
+                              const PresolveOptions& options);
+
+    // Install a result on the search's working copy of the variables
+    // (reduced domains, fixed values)
+    static void apply(const PresolveResult& result,
+                      std::vector<std::unique_ptr<Variable>>& working);
+
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    // The passes below operate on run()'s working copy
+
+    // Node consistency: filter domains by unary constraints, then drop them
+    // Returns false if a domain becomes empty
+    static bool foldUnaryConstraints(std::vector<std::unique_ptr<Variable>>& variables,
+                                     std::vector<std::shared_ptr<Constraint>>& constraints,
+                                     PresolveResult& result);
+
+    // Drop constraints equivalent to or subsumed by another constraint
+    static void mergeRedundantConstraints(std::vector<std::shared_ptr<Constraint>>& constraints,
+                                          PresolveResult& result);
+
+    // Fix singleton-domain variables and drop constraints whose scope is
+    // entirely fixed (after checking them)
+    // Returns false if a fully fixed constraint is violated
+    static bool eliminateFixedVariables(std::vector<std::unique_ptr<Variable>>& variables,
+                                        std::vector<std::shared_ptr<Constraint>>& constraints,
+                                        PresolveResult& result);
+
+    // Singleton arc consistency: remove every value whose assignment makes
+    // AC-3 fail. Stops early (sound, but incomplete) once deadline passes
+    // Returns false if a domain becomes empty
+    static bool singletonArcConsistency(
+        std::vector<std::unique_ptr<Variable>>& variables,
+        const std::vector<std::shared_ptr<Constraint>>& constraints,
+        std::optional<Clock::time_point> deadline, PresolveResult& result);
+};
+
+}  // namespace internal
+}  // namespace bolt
@@ -1,13 +1,22 @@
 #pragma once
 
 #include "constraint.hpp"
+#include "explanation.hpp"
+#include "local_search.hpp"
+#include "objective.hpp"
+#include "presolve.hpp"
 #include "propagation.hpp"
+#include "tuning/autotuner.hpp"
 #include "variable.hpp"
 #include <bolt/bolt.hpp>
 #include <bolt/types.hpp>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace bolt {
@@ -24,6 +33,7 @@ public:
 
     // Problem construction
     void addVariable(const VariableId& id, const DomainValues& domain);
+    void addVariable(const VariableId& id, int min, int max);
     void addConstraint(std::shared_ptr<Constraint> constraint);
     void clear();
 
@@ -31,12 +41,25 @@ public:
     Solution solve();
     bool isConsistent(const Assignment& assignment) const;
     ValidationResult validate(const Assignment& assignment) const;
+    RepairResult repair(const Assignment& proposal);
+    ValidationResult explainInfeasibility();
+
+    // Optimization
+    void setObjective(std::shared_ptr<Objective> objective);
+    Solution optimize(const CSPSolver::SolutionCallback& on_improvement);
+    void setOptimizationMode(CSPSolver::OptimizationMode mode);
+    void setLargeNeighborhoodOptions(const LargeNeighborhoodOptions& options);
 
     // Configuration
     void setTimeout(double timeout_ms);
     void setPropagationEnabled(bool enabled);
     void setVariableOrdering(CSPSolver::VariableOrdering ordering);
     void setValueOrdering(CSPSolver::ValueOrdering ordering);
+    void setAutoTuningEnabled(bool enabled);
+    bool loadTuningModel(const std::string& path);
+    void setPresolveOptions(const PresolveOptions& options);
+    void setLocalSearchOptions(const LocalSearchOptions& options);
+    void setExplanationOptions(const ExplanationOptions& options);
 
     // Statistics
     SolverStats getStatistics() const;
@@ -44,24 +67,88 @@ public:
 
 private:
     // Data members
+    // variables_ hold the problem as built (original domains); presolve and
+    // search never modify them. Non-search entry points (validate, repair,
+    // explainInfeasibility) read these
     std::vector<std::unique_ptr<Variable>> variables_;
     std::vector<std::shared_ptr<Constraint>> constraints_;
 
+    // Working copy for one solve/optimize: original domains with the
+    // presolve result applied. All search code operates on these
+    std::vector<std::unique_ptr<Variable>> search_variables_;
+
     // Configuration
     double timeout_ms_ = 0.0;  // 0 = no timeout
     bool propagation_enabled_ = true;
     CSPSolver::VariableOrdering var_ordering_ = CSPSolver::VariableOrdering::MRV;
     CSPSolver::ValueOrdering val_ordering_ = CSPSolver::ValueOrdering::Natural;
+    PresolveOptions presolve_options_;
+    bool auto_tuning_enabled_ = false;
+    std::shared_ptr<const AutoTuner> tuner_;  // Shared: models are read-only
+
+    // Tuner's choice for the current solve only. The setters above are never
+    // overwritten, so disabling auto-tuning restores the user's settings
+    std::optional<SolverConfiguration> tuned_config_;
+    LocalSearchOptions local_search_options_;
+    ExplanationOptions explanation_options_;
+    CSPSolver::OptimizationMode opt_mode_ = CSPSolver::OptimizationMode::BranchAndBound;
+    LargeNeighborhoodOptions lns_options_;
+
+    // Optimization state
+    std::shared_ptr<Objective> objective_;  // Shared, never modified by the solver
+    std::unique_ptr<BoundObjective> bound_objective_;  // For the running optimize() only
+    std::optional<Assignment> incumbent_;
+    double incumbent_cost_ = 0.0;
+    size_t node_limit_ = 0;  // 0 = unlimited (set for LNS sub-solves)
+    size_t node_limit_start_ = 0;
+    bool search_stopped_ = false;  // Callback requested stop
+
+    // Presolve cache: reused across solves while the problem and the
+    // effective options are unchanged. Reset by addVariable/addConstraint/
+    // clear and setPresolveOptions; rerun when the options in effect for a
+    // solve (including a tuned presolve_enabled) differ from presolved_with_
+    std::optional<PresolveResult> presolve_result_;
+    PresolveOptions presolved_with_;
 
     // Statistics
     mutable SolverStats stats_;
     std::chrono::high_resolution_clock::time_point solve_start_time_;
 
     // Core algorithms
+    // Rebuild search_variables_ from variables_ and apply presolve (run or
+    // replayed from the cache); false if presolve proved infeasibility
+    bool prepareSearch(const PresolveOptions& options);
+    bool presolve(const PresolveOptions& options);
     bool backtrack(Assignment& assignment);
     std::optional<Variable*> selectUnassignedVariable(const Assignment& assignment);
-    std::vector<ValueType> orderDomainValues(const Variable& var,
-                                              const Assignment& assignment);
+
+    // Visit candidate values for var in heuristic order; stops when visit
+    // returns false. Natural order walks a copy of the domain lazily
+    // (Domain::forEachValue); LeastConstraining/Random rank the values only
+    // for domains of at most MAX_RANKED_VALUES, otherwise use natural order
+    static constexpr size_t MAX_RANKED_VALUES = 1024;
+    void forEachOrderedValue(const Variable& var, const Assignment& assignment,
+                             const std::function<bool(const ValueType&)>& visit);
+
+    // Optimization
+    // Branch-and-bound: like backtrack(), but records every improving
+    // complete assignment and prunes nodes whose bound cannot beat it
+    void branchAndBound(Assignment& assignment,
+                        const CSPSolver::SolutionCallback& on_improvement);
+    // Uses bound_objective_->lowerBound(). optimize() creates it with
+    // objective_->bind() (letting std::invalid_argument for an unknown scope
+    // variable propagate) and resets it on return; branchAndBound() keeps
+    // Variable::assign/unassign in step with assignment
+    bool canImproveIncumbent() const;
+    bool recordImprovement(const Assignment& assignment,
+                           const CSPSolver::SolutionCallback& on_improvement);
+    void largeNeighborhoodSearch(const CSPSolver::SolutionCallback& on_improvement);
+    std::vector<Variable*> selectNeighborhood(size_t size, std::mt19937_64& rng);
+    bool isNodeLimitReached() const;
+
+    // Domain snapshots (LNS restores domains between neighborhoods)
+    std::vector<Domain> saveDomains() const;
+    void restoreDomains(const std::vector<Domain>& domains);
 
     // Consistency checking
     bool checkConstraints(const Assignment& assignment) const;
@@ -71,12 +158,41 @@ private:
     Variable* selectMRV(const Assignment& assignment);
     Variable* selectMaxDegree(const Assignment& assignment);
 
+    // Local search options with the termination fallback applied
+    // (see LocalSearchOptions)
+    LocalSearchOptions effectiveLocalSearchOptions() const;
+
+    // Auto-tuning: at solve() start, tuned_config_ is set from the tuner's
+    // choice (if enabled and a model is loaded) through a
+    // TunedConfigurationScope, which resets it when solve() returns or throws.
+    // Search code reads settings only through activeConfiguration()
+    class TunedConfigurationScope {
+    public:
+        TunedConfigurationScope(SolverImpl& solver, std::optional<SolverConfiguration> config)
+            : solver_(solver) {
+            solver_.tuned_config_ = std::move(config);
+        }
+        ~TunedConfigurationScope() { solver_.tuned_config_.reset(); }
+
+        TunedConfigurationScope(const TunedConfigurationScope&) = delete;
+        TunedConfigurationScope& operator=(const TunedConfigurationScope&) = delete;
+
+    private:
+        SolverImpl& solver_;
+    };
+    std::optional<SolverConfiguration> selectTunedConfiguration() const;
+    SolverConfiguration userConfiguration() const;    // From the setters
+    SolverConfiguration activeConfiguration() const;  // tuned_config_ or user settings
+
     // Timeout checking
     bool isTimedOut() const;
 
-    // Helper: Find variable by ID
+    // Helper: Find variable by ID (original problem)
     Variable* findVariable(const VariableId& id);
     const Variable* findVariable(const VariableId& id) const;
+
+    // Helper: Find variable by ID in search_variables_
+    Variable* findSearchVariable(const VariableId& id);
 };
 
 }  // namespace internal
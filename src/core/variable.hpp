@@ -19,8 +19,10 @@ class Constraint;
 
 class Variable {
 public:
-    // Constructor
+    // Constructors (domain kind is selected from the domain's shape)
     Variable(const VariableId& id, const DomainValues& domain);
+    Variable(const VariableId& id, int min, int max);  // Integer range [min, max]
+    Variable(const VariableId& id, Domain domain);     // Keeps the domain's kind
 
     // Identity
     const VariableId& id() const;
@@ -40,7 +42,19 @@ public:
     const std::vector<Constraint*>& constraints() const;
     size_t degree() const;  // Number of constraints
 
+    // Domain kind selection:
+    // - non-integer, small, or sparse (span > density * size) domains: Explicit
+    // - integer span up to SPARSE_SET_MAX_SPAN: SparseSet
+    // - larger integer spans: Interval
+    static constexpr size_t EXPLICIT_MAX_SIZE = 32;
+    static constexpr size_t SPARSE_SET_MAX_SPAN = size_t{1} << 16;
+    static constexpr size_t SPARSE_SET_MIN_DENSITY = 8;  // span <= 8 * size
+    static DomainKind selectDomainKind(const DomainValues& values);
+    static DomainKind selectDomainKind(int min, int max);
+
 private:
+    static Domain makeDomain(const DomainValues& values);
+
     VariableId id_;
     Domain domain_;
     std::optional<ValueType> assigned_value_;
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "tuning/features.hpp"
+#include "utils/config.hpp"
+#include <bolt/bolt.hpp>
+#include <filesystem>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// Forward declaration
+class SolverImpl;
+
+// ============================================================================
+// Solver Configuration: One point in the heuristic search space
+// ============================================================================
+
+struct SolverConfiguration {
+    CSPSolver::VariableOrdering variable_ordering = CSPSolver::VariableOrdering::MRV;
+    CSPSolver::ValueOrdering value_ordering = CSPSolver::ValueOrdering::Natural;
+    bool propagation_enabled = true;
+    bool presolve_enabled = true;
+
+    nlohmann::json toJson() const;
+    static std::optional<SolverConfiguration> fromJson(const nlohmann::json& json);
+
+    // Full grid of knob combinations raced during training
+    static std::vector<SolverConfiguration> candidates();
+};
+
+// ============================================================================
+// Auto-Tuner: Learned problem-class -> configuration mapping
+// ============================================================================
+
+class AutoTuner {
+public:
+    // Training instance: populates a solver with variables and constraints
+    struct TrainingProblem {
+        std::string name;
+        std::function<void(SolverImpl&)> build;
+    };
+
+    struct TrainingOptions {
+        double run_timeout_ms = 1000.0;  // Per (configuration, instance) run
+        double keep_fraction = 0.5;      // Survivors per racing round
+        size_t initial_instances = 2;    // Instances per configuration in round one
+        size_t repetitions = 1;          // Runs per instance (Random value ordering)
+    };
+
+    // Race candidate configurations separately for each problem class:
+    // successive halving over the class's instances, scoring by PAR2 time
+    // (runs cut off at run_timeout_ms count double) and keeping the fastest
+    // keep_fraction per round
+    void train(const std::vector<TrainingProblem>& problems, const TrainingOptions& options);
+
+    // Configuration for a problem: exact class match, otherwise the class
+    // with the nearest feature centroid, otherwise the defaults
+    SolverConfiguration select(const ProblemFeatures& features) const;
+
+    bool empty() const { return model_.empty(); }
+
+    // Model as JSON (class key -> centroid, configuration, score)
+    nlohmann::json toJson() const;
+    bool fromJson(const nlohmann::json& json);  // Leaves the model unchanged on error
+
+    // Standalone model files (written by bolt_tune); parsed into their own
+    // JSON document, never through the process-wide utils::Config
+    bool loadFromFile(const std::filesystem::path& path);
+    bool saveToFile(const std::filesystem::path& path) const;
+
+    // Embedding in the global configuration: reads/writes only the
+    // CONFIG_KEY entry, other keys are left untouched
+    static constexpr const char* CONFIG_KEY = "autotune";
+    void saveToConfig(utils::Config& config) const;
+    bool loadFromConfig(const utils::Config& config);
+
+private:
+    struct Entry {
+        std::vector<double> centroid;  // Mean ProblemFeatures::toVector()
+        SolverConfiguration config;
+        double score_ms;  // PAR2 mean of the winning configuration
+        size_t instances;
+    };
+
+    // Run one configuration on one instance, applied through the solver's
+    // setters on a fresh SolverImpl. Returns the elapsed time, or 2x
+    // run_timeout_ms if the run hit the timeout. A run that finishes in time
+    // without a solution (infeasibility proven) is a decided instance and
+    // counts its real time, like a solved one
+    static double runInstance(const TrainingProblem& problem, const SolverConfiguration& config,
+                              const TrainingOptions& options);
+
+    static SolverConfiguration race(const std::vector<const TrainingProblem*>& problems,
+                                    const TrainingOptions& options, double& best_score);
+
+    std::unordered_map<std::string, Entry> model_;  // Keyed by ProblemFeatures::classKey()
+};
+
+}  // namespace internal
+}  // namespace bolt
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "core/constraint.hpp"
+#include "core/variable.hpp"
+#include <bolt/types.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bolt {
+namespace internal {
+
+// ============================================================================
+// Problem Features: Cheap structural description of a CSP
+// ============================================================================
+
+struct ProblemFeatures {
+    size_t num_variables = 0;
+    size_t num_constraints = 0;
+
+    // Constraint graph
+    double avg_degree = 0.0;
+    size_t max_degree = 0;
+    double density = 0.0;  // avg_degree / (num_variables - 1); 0 if num_variables < 2
+
+    // Arity mix (fractions of num_constraints; all 0 if there are none)
+    double unary_fraction = 0.0;
+    double binary_fraction = 0.0;
+    double nary_fraction = 0.0;
+
+    // Domains
+    double avg_domain_size = 0.0;
+    size_t max_domain_size = 0;
+    double log2_search_space = 0.0;  // sum of log2(domain size)
+
+    // Coarse problem class: log2 buckets of size, domain size and density
+    // plus the dominant arity. Problems in one class share a configuration
+    std::string classKey() const;
+
+    // Normalized feature vector (log-scaled counts) for nearest-class lookup
+    std::vector<double> toVector() const;
+};
+
+class FeatureExtractor {
+public:
+    // One pass over variables and constraint scopes; no constraint checks
+    // and no domain materialization, so it is negligible next to a solve
+    static ProblemFeatures extract(const std::vector<std::unique_ptr<Variable>>& variables,
+                                   const std::vector<std::shared_ptr<Constraint>>& constraints);
+};
+
+}  // namespace internal
+}  // namespace bolt
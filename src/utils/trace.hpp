@@ -0,0 +1,201 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace bolt {
+namespace utils {
+
+// ============================================================================
+// Binary Search Trace Format
+// ============================================================================
+// File layout: TraceFileHeader, then a sequence of records. Each record is a
+// TraceRecordHeader followed by either `count` TraceEvents or a name entry
+// (uint32_t id + `count` bytes of UTF-8). Names map the subject ids used in
+// events back to variable/constraint ids.
+
+enum class TraceEventType : uint8_t {
+    SearchStart,
+    SearchEnd,
+    Decision,     // subject = variable, value = value index
+    Propagation,  // subject = constraint, aux = values removed
+    Failure,      // subject = constraint that wiped out a domain
+    Backjump,     // value = target depth
+    Restart,
+    Solution
+};
+
+// Fixed-size event record, written to disk as-is
+struct TraceEvent {
+    uint64_t timestamp_ns;  // Since TraceRecorder::start()
+    uint32_t subject;       // Interned variable/constraint id
+    uint32_t value;
+    uint32_t aux;
+    uint16_t depth;  // Search depth
+    TraceEventType type;
+    uint8_t thread;  // Recorder-assigned thread index (< TraceRecorder::MAX_THREADS)
+};
+static_assert(sizeof(TraceEvent) == 24, "TraceEvent is part of the file format");
+
+struct TraceFileHeader {
+    std::array<char, 8> magic;  // "BOLTTRC\0"
+    uint32_t version;
+    uint32_t event_size;  // sizeof(TraceEvent)
+};
+
+enum class TraceRecordKind : uint32_t { Events, VariableName, ConstraintName };
+
+struct TraceRecordHeader {
+    TraceRecordKind kind;
+    uint32_t count;
+};
+
+// ============================================================================
+// Per-Thread Trace Buffer
+// ============================================================================
+
+// Lock-free single-producer/single-consumer ring. The owning solver thread
+// pushes, the recorder's writer thread drains. When the ring is full, events
+// are dropped (and counted) instead of blocking the search. A buffer outlives
+// its thread: the recorder hands it (and its thread index) to the next new
+// thread, which keeps pushing after any events not yet drained.
+class TraceBuffer {
+public:
+    static constexpr size_t CAPACITY = size_t{1} << 14;  // Power of two
+
+    explicit TraceBuffer(uint8_t thread_index) : thread_index_(thread_index) {}
+
+    bool push(TraceEvent event) noexcept {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == CAPACITY) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        event.thread = thread_index_;
+        events_[head & (CAPACITY - 1)] = event;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: append all pending events to out
+    size_t drain(std::vector<TraceEvent>& out);
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::array<TraceEvent, CAPACITY> events_{};
+    alignas(64) std::atomic<uint64_t> head_{0};  // Written by producer
+    alignas(64) std::atomic<uint64_t> tail_{0};  // Written by consumer
+    std::atomic<uint64_t> dropped_{0};
+    uint8_t thread_index_;
+};
+
+// ============================================================================
+// Trace Recorder
+// ============================================================================
+
+class TraceRecorder {
+public:
+    // Singleton access
+    static TraceRecorder& instance();
+
+    // Start recording to file; spawns the async writer thread
+    bool start(const std::filesystem::path& path,
+               std::chrono::milliseconds flush_interval = std::chrono::milliseconds(10));
+
+    // Flush remaining events, stop the writer thread and free the buffers of
+    // threads that have exited (live threads keep theirs until they exit)
+    void stop();
+
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Map a variable/constraint id to a compact subject id (written once)
+    uint32_t internVariable(const std::string& name);
+    uint32_t internConstraint(const std::string& name);
+
+    // Hot path: one relaxed load when disabled, one ring push when enabled
+    void record(TraceEventType type, uint32_t subject, uint32_t value, uint16_t depth,
+                uint32_t aux = 0) {
+        if (!isEnabled()) {
+            return;
+        }
+        if (TraceBuffer* buffer = localBuffer()) {
+            buffer->push({nowNs(), subject, value, aux, depth, type, 0});
+        } else {
+            unbuffered_events_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Events lost because a buffer was full or the thread had none
+    uint64_t droppedEvents() const;
+
+    // Threads that can trace at once; a thread index must fit TraceEvent::thread
+    static constexpr size_t MAX_THREADS = 256;
+
+private:
+    TraceRecorder() = default;
+    ~TraceRecorder();
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t nowNs() const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time_)
+                .count());
+    }
+
+    // Buffer of the calling thread, acquired on first use and released by a
+    // thread_local lease when the thread exits. nullptr if MAX_THREADS
+    // threads already hold buffers (their events are counted as dropped)
+    TraceBuffer* localBuffer();
+    TraceBuffer* acquireBuffer();
+    void releaseBuffer(TraceBuffer* buffer);
+
+    uint32_t intern(std::unordered_map<std::string, uint32_t>& table, TraceRecordKind kind,
+                    const std::string& name);
+
+    // Writer thread: drain all buffers every flush interval
+    void writerLoop(std::stop_token stop, std::chrono::milliseconds flush_interval);
+    void flush();
+
+    std::atomic<bool> enabled_{false};
+    Clock::time_point start_time_;
+
+    // Buffers by thread index. Indices in free_indices_ are not leased by a
+    // live thread: they are reused before new ones are created, and stop()
+    // frees their buffers (leaving null) after the final flush
+    std::mutex buffers_mutex_;  // Guards the pool, not the event path
+    std::vector<std::unique_ptr<TraceBuffer>> buffers_;
+    std::vector<uint8_t> free_indices_;
+    uint64_t freed_dropped_ = 0;  // dropped() of buffers freed by stop()
+    std::atomic<uint64_t> unbuffered_events_{0};
+
+    std::mutex file_mutex_;  // Guards names and the output file
+    std::unordered_map<std::string, uint32_t> variable_names_;
+    std::unordered_map<std::string, uint32_t> constraint_names_;
+    std::FILE* file_ = nullptr;
+
+    std::jthread writer_;
+};
+
+// Convenience macro; compiled out unless BOLT_ENABLE_SEARCH_TRACE is defined
+#ifdef BOLT_ENABLE_SEARCH_TRACE
+#define BOLT_TRACE_EVENT(...) bolt::utils::TraceRecorder::instance().record(__VA_ARGS__)
+#else
+#define BOLT_TRACE_EVENT(...) ((void)0)
+#endif
+
+}  // namespace utils
+}  // namespace bolt
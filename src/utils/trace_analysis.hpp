@@ -0,0 +1,80 @@
+#pragma once
+
+#include "trace.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bolt {
+namespace utils {
+
+// ============================================================================
+// Trace Reader: Loads a binary trace written by TraceRecorder
+// ============================================================================
+
+struct TraceData {
+    std::vector<TraceEvent> events;  // Sorted by (thread, timestamp)
+    std::unordered_map<uint32_t, std::string> variable_names;
+    std::unordered_map<uint32_t, std::string> constraint_names;
+};
+
+class TraceReader {
+public:
+    // Returns nullopt on unreadable file, bad magic, or version mismatch
+    static std::optional<TraceData> read(const std::filesystem::path& path);
+};
+
+// ============================================================================
+// Trace Analyzer: Offline search statistics
+// ============================================================================
+
+class TraceAnalyzer {
+public:
+    explicit TraceAnalyzer(TraceData data);
+
+    struct SearchTreeStats {
+        size_t decisions;
+        size_t propagations;
+        size_t failures;
+        size_t backjumps;
+        size_t restarts;
+        size_t solutions;
+        size_t max_depth;
+        double avg_backjump_distance;
+        double total_time_ms;
+        std::vector<size_t> nodes_per_depth;
+    };
+
+    struct ConstraintActivity {
+        std::string constraint;
+        size_t propagations;
+        size_t values_removed;
+        size_t failures;
+        double time_ms;  // Time attributed to its propagation events
+    };
+
+    SearchTreeStats searchTreeStats() const;
+
+    // Constraints ranked by failures, then propagation time
+    std::vector<ConstraintActivity> hotConstraints(size_t top_n) const;
+
+    // Flame-graph input in folded-stack format ("x=1;y=0;z=2 <ns>"): time
+    // spent under each decision path, truncated at max_depth
+    void writeFoldedStacks(std::ostream& out, size_t max_depth) const;
+
+    // Human-readable report of all of the above
+    void printReport(std::ostream& out, size_t top_n) const;
+
+private:
+    std::string variableName(uint32_t id) const;
+    std::string constraintName(uint32_t id) const;
+
+    TraceData data_;
+};
+
+}  // namespace utils
+}  // namespace bolt
@@ -0,0 +1,82 @@
+#include <bolt/bolt.hpp>
+#include <gtest/gtest.h>
+#include <variant>
+
+namespace bolt {
+namespace {
+
+// Presolve folds x > 5 into x's domain and proves infeasibility before
+// search; the explanation must still start from x in {1, 2, 3} and blame
+// the unary constraint alone, not every constraint touching x
+TEST(ExplanationTest, ExplainsAfterPresolveProvesInfeasibility) {
+    CSPSolver solver;
+    solver.addVariable("x", 1, 3);
+    solver.addVariable("y", 1, 3);
+    solver.addVariable("z", 1, 3);
+    solver.addConstraint(
+        UnaryConstraint("x", [](const ValueType& v) { return std::get<int>(v) > 5; }));
+    solver.addConstraint(NotEqual("x", "y"));
+    solver.addConstraint(LessThan("y", "z"));
+
+    PresolveOptions presolve;
+    presolve.enabled = true;
+    presolve.fold_unary_constraints = true;
+    solver.setPresolveOptions(presolve);
+
+    Solution solution = solver.solve();
+    ASSERT_FALSE(solution.is_satisfied);
+
+    ValidationResult result = solver.explainInfeasibility();
+    EXPECT_FALSE(result.is_valid);
+    EXPECT_TRUE(result.is_conclusive);
+    ASSERT_EQ(result.violations.size(), 1u);
+    ASSERT_EQ(result.violations[0].involved_variables.size(), 1u);
+    EXPECT_EQ(result.violations[0].involved_variables[0], "x");
+}
+
+// SAC empties every domain of the pigeonhole core; the unrelated
+// constraint must not appear in the explanation
+TEST(ExplanationTest, ExplainsAfterSingletonArcConsistency) {
+    CSPSolver solver;
+    solver.addVariable("a", 1, 2);
+    solver.addVariable("b", 1, 2);
+    solver.addVariable("c", 1, 2);
+    solver.addVariable("d", 1, 2);
+    solver.addConstraint(AllDifferent({"a", "b", "c"}));
+    solver.addConstraint(LessThanOrEqual("c", "d"));
+
+    PresolveOptions presolve;
+    presolve.singleton_arc_consistency = true;
+    presolve.sac_time_limit_ms = 0.0;
+    solver.setPresolveOptions(presolve);
+
+    ASSERT_FALSE(solver.solve().is_satisfied);
+
+    ValidationResult result = solver.explainInfeasibility();
+    EXPECT_FALSE(result.is_valid);
+    EXPECT_TRUE(result.is_conclusive);
+    ASSERT_EQ(result.violations.size(), 1u);
+    EXPECT_EQ(result.violations[0].involved_variables.size(), 3u);
+}
+
+// Explaining twice (second time from the cached presolve) gives the same core
+TEST(ExplanationTest, RepeatedExplanationIsStable) {
+    CSPSolver solver;
+    solver.addVariable("x", 1, 3);
+    solver.addVariable("y", 1, 3);
+    solver.addConstraint(
+        UnaryConstraint("x", [](const ValueType& v) { return std::get<int>(v) > 5; }));
+    solver.addConstraint(NotEqual("x", "y"));
+
+    ASSERT_FALSE(solver.solve().is_satisfied);
+    ValidationResult first = solver.explainInfeasibility();
+    ASSERT_FALSE(solver.solve().is_satisfied);
+    ValidationResult second = solver.explainInfeasibility();
+
+    ASSERT_EQ(first.violations.size(), 1u);
+    ASSERT_EQ(second.violations.size(), 1u);
+    EXPECT_EQ(first.violations[0].constraint_name, second.violations[0].constraint_name);
+}
+
+}  // namespace
+}  // namespace bolt